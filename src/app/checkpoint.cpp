@@ -0,0 +1,360 @@
+#include "app/checkpoint.hpp"
+
+#include "app/playerData.hpp"
+#include "app/playerSlots.hpp"
+#include "app/udp/udpSerializer.hpp"
+#include "common/config.hpp"
+#include "common/mapName.hpp"
+#include "physics/playerInfo.hpp"
+#include "physics/simulationClock.hpp"
+#include "physics/timestep.hpp"
+
+#include <asio/asio.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+namespace App
+{
+	namespace
+	{
+		constexpr std::array<std::uint8_t, 4> magic{'P', 'O', 'S', 'C'};
+		constexpr std::uint32_t version = 5;
+
+		constexpr std::uint8_t addressFamilyV4 = 4;
+		constexpr std::uint8_t addressFamilyV6 = 6;
+
+		void writeBytes(std::vector<std::uint8_t>& buffer, const void* data, std::size_t size)
+		{
+			const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+			buffer.insert(buffer.end(), bytes, bytes + size);
+		}
+
+		void writeUInt(std::vector<std::uint8_t>& buffer, std::uint32_t value)
+		{
+			for (int byte = 0; byte < 4; ++byte)
+			{
+				buffer.push_back(static_cast<std::uint8_t>(value >> (8 * byte)));
+			}
+		}
+
+		void writeUInt64(std::vector<std::uint8_t>& buffer, std::uint64_t value)
+		{
+			writeUInt(buffer, static_cast<std::uint32_t>(value));
+			writeUInt(buffer, static_cast<std::uint32_t>(value >> 32));
+		}
+
+		void writeTimestep(std::vector<std::uint8_t>& buffer, const Physics::Timestep& timestep)
+		{
+			writeUInt(buffer, static_cast<std::uint32_t>(timestep.second));
+			writeUInt(buffer, static_cast<std::uint32_t>(timestep.step));
+		}
+
+		void writeEndpoint(std::vector<std::uint8_t>& buffer,
+			const asio::ip::udp::endpoint& endpoint)
+		{
+			if (endpoint.address().is_v4())
+			{
+				buffer.push_back(addressFamilyV4);
+				asio::ip::address_v4::bytes_type address = endpoint.address().to_v4().to_bytes();
+				writeBytes(buffer, address.data(), address.size());
+			}
+			else
+			{
+				buffer.push_back(addressFamilyV6);
+				asio::ip::address_v6::bytes_type address = endpoint.address().to_v6().to_bytes();
+				writeBytes(buffer, address.data(), address.size());
+			}
+			writeUInt(buffer, endpoint.port());
+		}
+
+		Physics::Timestep shiftTimestep(const Physics::Timestep& timestep,
+			const Physics::Timestep& shift, bool forward)
+		{
+			if (forward)
+			{
+				return timestep + shift;
+			}
+			return shift < timestep ? timestep - shift : Physics::Timestep{};
+		}
+
+		class Reader
+		{
+		public:
+			Reader(const std::vector<std::uint8_t>& buffer) :
+				m_buffer{buffer}
+			{ }
+
+			bool readBytes(void* data, std::size_t size)
+			{
+				if (m_buffer.size() - m_offset < size)
+				{
+					return false;
+				}
+				std::memcpy(data, m_buffer.data() + m_offset, size);
+				m_offset += size;
+				return true;
+			}
+
+			bool readUInt(std::uint32_t& value)
+			{
+				std::array<std::uint8_t, 4> bytes{};
+				if (!readBytes(bytes.data(), bytes.size()))
+				{
+					return false;
+				}
+				value = 0;
+				for (std::size_t byte = 0; byte < bytes.size(); ++byte)
+				{
+					value |= static_cast<std::uint32_t>(bytes[byte]) << (8 * byte);
+				}
+				return true;
+			}
+
+			bool readUInt64(std::uint64_t& value)
+			{
+				std::uint32_t low{};
+				std::uint32_t high{};
+				if (!readUInt(low) || !readUInt(high))
+				{
+					return false;
+				}
+				value = static_cast<std::uint64_t>(high) << 32 | low;
+				return true;
+			}
+
+			bool readTimestep(Physics::Timestep& timestep)
+			{
+				std::uint32_t second{};
+				std::uint32_t step{};
+				if (!readUInt(second) || !readUInt(step))
+				{
+					return false;
+				}
+				timestep = Physics::Timestep{static_cast<unsigned int>(second),
+					static_cast<unsigned int>(step)};
+				return true;
+			}
+
+			bool readEndpoint(asio::ip::udp::endpoint& endpoint)
+			{
+				std::uint8_t addressFamily{};
+				if (!readBytes(&addressFamily, sizeof(addressFamily)))
+				{
+					return false;
+				}
+
+				asio::ip::address address{};
+				if (addressFamily == addressFamilyV4)
+				{
+					asio::ip::address_v4::bytes_type bytes{};
+					if (!readBytes(bytes.data(), bytes.size()))
+					{
+						return false;
+					}
+					address = asio::ip::address_v4{bytes};
+				}
+				else if (addressFamily == addressFamilyV6)
+				{
+					asio::ip::address_v6::bytes_type bytes{};
+					if (!readBytes(bytes.data(), bytes.size()))
+					{
+						return false;
+					}
+					address = asio::ip::address_v6{bytes};
+				}
+				else
+				{
+					return false;
+				}
+
+				std::uint32_t port{};
+				if (!readUInt(port))
+				{
+					return false;
+				}
+				endpoint = asio::ip::udp::endpoint{address, static_cast<asio::ip::port_type>(port)};
+				return true;
+			}
+
+			std::vector<std::uint8_t> readRemainder()
+			{
+				std::vector<std::uint8_t> remainder(m_buffer.begin() +
+					static_cast<std::ptrdiff_t>(m_offset), m_buffer.end());
+				m_offset = m_buffer.size();
+				return remainder;
+			}
+
+		private:
+			const std::vector<std::uint8_t>& m_buffer;
+			std::size_t m_offset{};
+		};
+	};
+
+	bool saveCheckpoint(const std::string& path, Common::MapName mapName,
+		const Physics::SimulationClock& simulationClock, const Physics::Timestep& timestep,
+		const std::unordered_map<int, Physics::PlayerInfo>& playerInfos,
+		const PlayerSlots<PlayerData>& players)
+	{
+		std::vector<std::uint8_t> buffer{};
+		writeBytes(buffer, magic.data(), magic.size());
+		writeUInt(buffer, version);
+		writeUInt(buffer, static_cast<std::uint32_t>(Common::toSizeT(mapName)));
+		writeTimestep(buffer, timestep);
+		writeTimestep(buffer, simulationClock.getTime());
+		writeUInt64(buffer, static_cast<std::uint64_t>(
+			std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count()));
+
+		std::uint32_t playerCount = 0;
+		players.forEach
+		(
+			[&playerCount] (int, const PlayerData&)
+			{
+				++playerCount;
+			}
+		);
+		writeUInt(buffer, playerCount);
+		players.forEach
+		(
+			[&buffer] (int playerId, const PlayerData& playerData)
+			{
+				writeUInt(buffer, static_cast<std::uint32_t>(playerId));
+				writeEndpoint(buffer, playerData.endpoint);
+				writeTimestep(buffer, playerData.keepAliveTimestep);
+				buffer.push_back(playerData.keepAliveLock ? 1 : 0);
+				buffer.push_back(playerData.verified ? 1 : 0);
+			}
+		);
+
+		std::vector<std::uint8_t> stateFrame{};
+		UDPSerializer::serializeStateFrame(timestep, playerInfos, stateFrame);
+		buffer.insert(buffer.end(), stateFrame.begin(), stateFrame.end());
+
+		std::string temporaryPath = path + ".tmp";
+		std::ofstream file{temporaryPath, std::ios::binary | std::ios::trunc};
+		file.write(reinterpret_cast<const char*>(buffer.data()),
+			static_cast<std::streamsize>(buffer.size()));
+		file.close();
+		if (!file)
+		{
+			return false;
+		}
+
+		std::error_code errorCode{};
+		std::filesystem::rename(temporaryPath, path, errorCode);
+		return !errorCode;
+	}
+
+	bool loadCheckpoint(const std::string& path, Checkpoint& checkpoint)
+	{
+		std::ifstream file{path, std::ios::binary};
+		if (!file)
+		{
+			return false;
+		}
+		std::vector<std::uint8_t> buffer{std::istreambuf_iterator<char>{file},
+			std::istreambuf_iterator<char>{}};
+
+		Reader reader{buffer};
+		std::array<std::uint8_t, 4> fileMagic{};
+		std::uint32_t fileVersion{};
+		std::uint32_t mapName{};
+		std::uint64_t clockSystemTime{};
+		if (!reader.readBytes(fileMagic.data(), fileMagic.size()) || fileMagic != magic ||
+			!reader.readUInt(fileVersion) || fileVersion != version ||
+			!reader.readUInt(mapName) || mapName >= static_cast<std::uint32_t>(Common::mapCount) ||
+			!reader.readTimestep(checkpoint.timestep) ||
+			!reader.readTimestep(checkpoint.clockTimestep) ||
+			!reader.readUInt64(clockSystemTime))
+		{
+			return false;
+		}
+		checkpoint.mapName = static_cast<Common::MapName>(mapName);
+		checkpoint.clockSystemTime = std::chrono::system_clock::time_point{
+			std::chrono::duration_cast<std::chrono::system_clock::duration>(
+			std::chrono::milliseconds{clockSystemTime})};
+
+		std::uint32_t playerCount{};
+		if (!reader.readUInt(playerCount) || playerCount > Common::maxPlayerCount)
+		{
+			return false;
+		}
+		for (std::uint32_t i = 0; i < playerCount; ++i)
+		{
+			std::uint32_t playerId{};
+			PlayerData playerData{};
+			std::uint8_t keepAliveLock{};
+			std::uint8_t verified{};
+			if (!reader.readUInt(playerId) || playerId >= Common::maxPlayerCount ||
+				!reader.readEndpoint(playerData.endpoint) ||
+				!reader.readTimestep(playerData.keepAliveTimestep) ||
+				!reader.readBytes(&keepAliveLock, sizeof(keepAliveLock)) ||
+				!reader.readBytes(&verified, sizeof(verified)))
+			{
+				return false;
+			}
+			playerData.keepAliveLock = keepAliveLock != 0;
+			playerData.verified = verified != 0;
+			checkpoint.players.insert(static_cast<int>(playerId), playerData);
+		}
+
+		std::vector<std::uint8_t> stateFrame = reader.readRemainder();
+		Physics::Timestep stateFrameTimestep{};
+		try
+		{
+			UDPSerializer::deserializeStateFrame(stateFrame, stateFrameTimestep,
+				checkpoint.playerInfos);
+		}
+		catch (std::exception&)
+		{
+			return false;
+		}
+		return true;
+	}
+
+	bool rebaseCheckpoint(Checkpoint& checkpoint, const Physics::Timestep& clockTimestep,
+		const std::chrono::system_clock::time_point& clockSystemTime)
+	{
+		if (clockSystemTime < checkpoint.clockSystemTime)
+		{
+			return false;
+		}
+
+		long long elapsedSteps = std::chrono::duration_cast<std::chrono::milliseconds>(
+			clockSystemTime - checkpoint.clockSystemTime).count() * Common::stepsPerSecond / 1000;
+		Physics::Timestep expectedClockTimestep = checkpoint.clockTimestep +
+			Physics::Timestep
+			{
+				static_cast<unsigned int>(elapsedSteps / Common::stepsPerSecond),
+				static_cast<unsigned int>(elapsedSteps % Common::stepsPerSecond)
+			};
+
+		bool forward = clockTimestep > expectedClockTimestep;
+		Physics::Timestep shift = forward ? clockTimestep - expectedClockTimestep :
+			expectedClockTimestep - clockTimestep;
+		checkpoint.timestep = shiftTimestep(checkpoint.timestep, shift, forward);
+		checkpoint.clockTimestep = shiftTimestep(checkpoint.clockTimestep, shift, forward);
+		for (int playerId = 0; playerId < static_cast<int>(Common::maxPlayerCount); ++playerId)
+		{
+			if (checkpoint.players.contains(playerId))
+			{
+				PlayerData& playerData = checkpoint.players.at(playerId);
+				playerData.keepAliveTimestep =
+					shiftTimestep(playerData.keepAliveTimestep, shift, forward);
+			}
+		}
+		return true;
+	}
+};
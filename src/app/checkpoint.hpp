@@ -0,0 +1,33 @@
+#pragma once
+
+#include "app/playerData.hpp"
+#include "app/playerSlots.hpp"
+#include "common/mapName.hpp"
+#include "physics/playerInfo.hpp"
+#include "physics/simulationClock.hpp"
+#include "physics/timestep.hpp"
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+namespace App
+{
+	struct Checkpoint
+	{
+		Common::MapName mapName{};
+		Physics::Timestep timestep{};
+		Physics::Timestep clockTimestep{};
+		std::chrono::system_clock::time_point clockSystemTime{};
+		std::unordered_map<int, Physics::PlayerInfo> playerInfos{};
+		PlayerSlots<PlayerData> players{};
+	};
+
+	bool saveCheckpoint(const std::string& path, Common::MapName mapName,
+		const Physics::SimulationClock& simulationClock, const Physics::Timestep& timestep,
+		const std::unordered_map<int, Physics::PlayerInfo>& playerInfos,
+		const PlayerSlots<PlayerData>& players);
+	bool loadCheckpoint(const std::string& path, Checkpoint& checkpoint);
+	bool rebaseCheckpoint(Checkpoint& checkpoint, const Physics::Timestep& clockTimestep,
+		const std::chrono::system_clock::time_point& clockSystemTime);
+};
@@ -5,13 +5,15 @@
 namespace App
 {
 	inline constexpr int argumentCount = 4;
+	inline constexpr int optionalArgumentCount = 1;
 
 	enum class CommandLineArgument
 	{
 		programName,
 		map,
 		networkThreadPort,
-		physicsThreadPort
+		physicsThreadPort,
+		checkpointPath
 	};
 
 	std::size_t toSizeT(CommandLineArgument commandLineArgument);
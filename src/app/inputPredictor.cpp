@@ -0,0 +1,75 @@
+#include "app/inputPredictor.hpp"
+
+#include "app/udp/udpSerializer.hpp"
+#include "physics/playerInput.hpp"
+#include "physics/timestamp.hpp"
+#include "physics/timestep.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace App
+{
+	void InputPredictor::reset(int playerId, const Physics::Timestep& timestep,
+		const Physics::PlayerInput& playerInput)
+	{
+		LastInput lastInput{timestep, {}};
+		encode(playerInput, lastInput.encodedInput);
+		m_lastInputs.insert(playerId, lastInput);
+	}
+
+	void InputPredictor::erase(int playerId)
+	{
+		m_lastInputs.erase(playerId);
+	}
+
+	bool InputPredictor::matchesPrediction(int playerId, const Physics::Timestep& timestep,
+		const Physics::PlayerInput& playerInput)
+	{
+		if (!m_lastInputs.contains(playerId))
+		{
+			++m_missCount;
+			return false;
+		}
+
+		LastInput& lastInput = m_lastInputs.at(playerId);
+		if (!(timestep > lastInput.timestep))
+		{
+			++m_missCount;
+			return false;
+		}
+
+		encode(playerInput, m_encodedInput);
+		bool hit = m_encodedInput == lastInput.encodedInput;
+		lastInput.timestep = timestep;
+		if (hit)
+		{
+			++m_hitCount;
+		}
+		else
+		{
+			++m_missCount;
+			std::swap(lastInput.encodedInput, m_encodedInput);
+		}
+		return hit;
+	}
+
+	unsigned long long InputPredictor::getHitCount() const
+	{
+		return m_hitCount;
+	}
+
+	unsigned long long InputPredictor::getMissCount() const
+	{
+		return m_missCount;
+	}
+
+	void InputPredictor::encode(const Physics::PlayerInput& playerInput,
+		std::vector<std::uint8_t>& encodedInput)
+	{
+		encodedInput.clear();
+		UDPSerializer::serializeControlFrame(Physics::Timestamp{}, Physics::Timestamp{},
+			Physics::Timestep{}, 0, playerInput, encodedInput);
+	}
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "app/playerSlots.hpp"
+#include "physics/playerInput.hpp"
+#include "physics/timestep.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace App
+{
+	class InputPredictor
+	{
+	public:
+		void reset(int playerId, const Physics::Timestep& timestep,
+			const Physics::PlayerInput& playerInput);
+		void erase(int playerId);
+		bool matchesPrediction(int playerId, const Physics::Timestep& timestep,
+			const Physics::PlayerInput& playerInput);
+		unsigned long long getHitCount() const;
+		unsigned long long getMissCount() const;
+
+	private:
+		struct LastInput
+		{
+			Physics::Timestep timestep{};
+			std::vector<std::uint8_t> encodedInput{};
+		};
+
+		PlayerSlots<LastInput> m_lastInputs{};
+		std::vector<std::uint8_t> m_encodedInput{};
+		unsigned long long m_hitCount{};
+		unsigned long long m_missCount{};
+
+		static void encode(const Physics::PlayerInput& playerInput,
+			std::vector<std::uint8_t>& encodedInput);
+	};
+};
@@ -10,7 +10,7 @@
 namespace App
 {
 	bool parseArguments(int argc, char** argv, Common::MapName& mapName, int& networkThreadPort,
-		int& physicsThreadPort);
+		int& physicsThreadPort, std::string& checkpointPath);
 };
 
 int main(int argc, char** argv)
@@ -20,15 +20,18 @@ int main(int argc, char** argv)
 	Common::MapName mapName{};
 	int networkThreadPort{};
 	int physicsThreadPort{};
+	std::string checkpointPath{};
 
-	if (!parseArguments(argc, argv, mapName, networkThreadPort, physicsThreadPort))
+	if (!parseArguments(argc, argv, mapName, networkThreadPort, physicsThreadPort,
+		checkpointPath))
 	{
 		return toInt(ExitCode::badArguments);
 	}
 
 	ExitSignal exitSignal{};
 	std::unique_ptr<NetworkThread> networkThread =
-		std::make_unique<NetworkThread>(exitSignal, mapName, networkThreadPort, physicsThreadPort);
+		std::make_unique<NetworkThread>(exitSignal, mapName, networkThreadPort, physicsThreadPort,
+		checkpointPath);
 	networkThread->start();
 
 	return toInt(exitSignal.getExitCode());
@@ -37,9 +40,9 @@ int main(int argc, char** argv)
 namespace App
 {
 	bool parseArguments(int argc, char** argv, Common::MapName& mapName,
-		int& networkThreadPort, int& physicsThreadPort)
+		int& networkThreadPort, int& physicsThreadPort, std::string& checkpointPath)
 	{
-		if (argc != argumentCount)
+		if (argc < argumentCount || argc > argumentCount + optionalArgumentCount)
 		{
 			return false;
 		}
@@ -66,6 +69,11 @@ namespace App
 			return false;
 		}
 
+		if (argc == argumentCount + optionalArgumentCount)
+		{
+			checkpointPath = argv[toSizeT(CommandLineArgument::checkpointPath)];
+		}
+
 		return true;
 	}
 };
@@ -0,0 +1,86 @@
+#include "app/overloadController.hpp"
+
+#include "app/overloadStage.hpp"
+#include "common/config.hpp"
+#include "physics/timestep.hpp"
+
+#include <chrono>
+
+namespace App
+{
+	bool OverloadController::update(bool behind)
+	{
+		static constexpr std::chrono::milliseconds escalationDelay{500};
+		static constexpr std::chrono::seconds deescalationDelay{5};
+
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		OverloadStage stage = m_stage.load();
+		if (behind)
+		{
+			m_healthySince = {};
+			if (m_behindSince == std::chrono::steady_clock::time_point{})
+			{
+				m_behindSince = now;
+			}
+			if (now - m_behindSince >= escalationDelay && stage != OverloadStage::refusingJoins)
+			{
+				m_behindSince = now;
+				m_stage.store(static_cast<OverloadStage>(toInt(stage) + 1));
+				return true;
+			}
+		}
+		else
+		{
+			m_behindSince = {};
+			if (m_healthySince == std::chrono::steady_clock::time_point{})
+			{
+				m_healthySince = now;
+			}
+			if (now - m_healthySince >= deescalationDelay && stage != OverloadStage::normal)
+			{
+				m_healthySince = now;
+				m_stage.store(static_cast<OverloadStage>(toInt(stage) - 1));
+				return true;
+			}
+		}
+		return false;
+	}
+
+	OverloadStage OverloadController::getStage() const
+	{
+		return m_stage.load();
+	}
+
+	Physics::Timestep OverloadController::getRollbackWindow() const
+	{
+		static constexpr Physics::Timestep normalRollbackWindow{0,
+			static_cast<unsigned int>(Common::stepsPerSecond * 0.9f)};
+		static constexpr Physics::Timestep reducedRollbackWindow{0,
+			static_cast<unsigned int>(Common::stepsPerSecond * 0.3f)};
+
+		if (toInt(m_stage.load()) >= toInt(OverloadStage::reducedRollback))
+		{
+			return reducedRollbackWindow;
+		}
+		return normalRollbackWindow;
+	}
+
+	bool OverloadController::shouldBroadcastState()
+	{
+		static constexpr int reducedBroadcastInterval = 2;
+
+		if (toInt(m_stage.load()) < toInt(OverloadStage::reducedBroadcast))
+		{
+			m_skippedBroadcasts = 0;
+			return true;
+		}
+
+		if (m_skippedBroadcasts + 1 >= reducedBroadcastInterval)
+		{
+			m_skippedBroadcasts = 0;
+			return true;
+		}
+		++m_skippedBroadcasts;
+		return false;
+	}
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "app/overloadStage.hpp"
+#include "physics/timestep.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace App
+{
+	class OverloadController
+	{
+	public:
+		bool update(bool behind);
+		OverloadStage getStage() const;
+		Physics::Timestep getRollbackWindow() const;
+		bool shouldBroadcastState();
+
+	private:
+		std::atomic<OverloadStage> m_stage{OverloadStage::normal};
+		std::chrono::steady_clock::time_point m_behindSince{};
+		std::chrono::steady_clock::time_point m_healthySince{};
+		int m_skippedBroadcasts{};
+	};
+};
@@ -0,0 +1,25 @@
+#include "app/overloadStage.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+namespace App
+{
+	int toInt(OverloadStage overloadStage)
+	{
+		return static_cast<int>(overloadStage);
+	}
+
+	std::string toString(OverloadStage overloadStage)
+	{
+		static const std::array<std::string, overloadStageCount> names
+		{
+			"normal",
+			"reducedRollback",
+			"reducedBroadcast",
+			"refusingJoins"
+		};
+		return names[static_cast<std::size_t>(toInt(overloadStage))];
+	}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+
+namespace App
+{
+	enum class OverloadStage
+	{
+		normal,
+		reducedRollback,
+		reducedBroadcast,
+		refusingJoins
+	};
+
+	inline constexpr int overloadStageCount = 4;
+
+	int toInt(OverloadStage overloadStage);
+	std::string toString(OverloadStage overloadStage);
+};
@@ -11,5 +11,6 @@ namespace App
 		asio::ip::udp::endpoint endpoint;
 		Physics::Timestep keepAliveTimestep{};
 		bool keepAliveLock{};
+		bool verified{};
 	};
 };
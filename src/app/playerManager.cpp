@@ -1,33 +1,38 @@
 #include "app/playerManager.hpp"
 
+#include "app/playerData.hpp"
+#include "app/playerSlots.hpp"
 #include "common/config.hpp"
 #include "physics/timestep.hpp"
 
 #include <asio/asio.hpp>
 
 #include <optional>
-#include <utility>
 #include <vector>
 
 namespace App
 {
 	std::optional<int> PlayerManager::getPlayerId(const asio::ip::udp::endpoint& endpoint) const
 	{
-		for (const std::pair<const int, PlayerData>& player : m_players)
-		{
-			if (player.second.endpoint == endpoint)
+		m_mutex.lock();
+
+		std::optional<int> playerId{};
+		m_players.forEach
+		(
+			[&endpoint, &playerId] (int id, const PlayerData& playerData)
 			{
-				return player.first;
+				if (!playerId && playerData.endpoint == endpoint)
+				{
+					playerId = id;
+				}
 			}
-		}
-		return std::nullopt;
-	}
+		);
 
-	bool PlayerManager::isPlayerIdValid(int playerId) const
-	{
-		return m_players.contains(playerId);
+		m_mutex.unlock();
+
+		return playerId;
 	}
-	
+
 	std::optional<int> PlayerManager::addNewPlayer(const asio::ip::udp::endpoint& endpoint,
 		const Physics::Timestep& timestep)
 	{
@@ -36,14 +41,15 @@ namespace App
 		std::optional<int> newPlayerId = getAvailableId();
 		if (newPlayerId)
 		{
-			static const Physics::Timestep timeout{10, 0};
-			m_players.insert({*newPlayerId,
+			static const Physics::Timestep verificationTimeout{2, 0};
+			m_players.insert(*newPlayerId,
 				PlayerData
 				{
 					endpoint,
-					timestep + timeout,
+					timestep + verificationTimeout,
+					false,
 					false
-				}});
+				});
 		}
 
 		m_mutex.unlock();
@@ -55,6 +61,7 @@ namespace App
 	{
 		m_mutex.lock();
 
+		m_players.at(playerId).verified = true;
 		if (!m_players.at(playerId).keepAliveLock)
 		{
 			static const Physics::Timestep timeout{10, 0};
@@ -69,15 +76,22 @@ namespace App
 		m_mutex.lock();
 
 		std::vector<int> kickedPlayerIds{};
-		for (const std::pair<const int, PlayerData>& player : m_players)
-		{
-			if (timestep > player.second.keepAliveTimestep)
+		m_players.forEach
+		(
+			[&timestep, &kickedPlayerIds] (int playerId, const PlayerData& playerData)
 			{
-				kickedPlayerIds.push_back(player.first);
+				if (timestep > playerData.keepAliveTimestep)
+				{
+					kickedPlayerIds.push_back(playerId);
+				}
 			}
-		}
+		);
 		for (int kickedPlayerId : kickedPlayerIds)
 		{
+			if (!m_players.at(kickedPlayerId).verified)
+			{
+				++m_unverifiedKickCount;
+			}
 			m_players.erase(kickedPlayerId);
 		}
 
@@ -86,15 +100,13 @@ namespace App
 		return kickedPlayerIds;
 	}
 
-	std::unordered_map<int, PlayerData> PlayerManager::getPlayers() const
+	void PlayerManager::getPlayers(PlayerSlots<PlayerData>& players) const
 	{
 		m_mutex.lock();
 
-		std::unordered_map<int, PlayerData> players = m_players;
+		players = m_players;
 
 		m_mutex.unlock();
-
-		return players;
 	}
 
 	void PlayerManager::killPlayer(int playerId, const Physics::Timestep& timestep)
@@ -111,6 +123,26 @@ namespace App
 		m_mutex.unlock();
 	}
 
+	void PlayerManager::restorePlayer(int playerId, const PlayerData& playerData)
+	{
+		m_mutex.lock();
+
+		m_players.insert(playerId, playerData);
+
+		m_mutex.unlock();
+	}
+
+	unsigned long long PlayerManager::getUnverifiedKickCount() const
+	{
+		m_mutex.lock();
+
+		unsigned long long unverifiedKickCount = m_unverifiedKickCount;
+
+		m_mutex.unlock();
+
+		return unverifiedKickCount;
+	}
+
 	std::optional<int> PlayerManager::getAvailableId()
 	{
 		int start = m_idCounter;
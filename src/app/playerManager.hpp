@@ -1,16 +1,14 @@
 #pragma once
 
 #include "app/playerData.hpp"
+#include "app/playerSlots.hpp"
 #include "common/config.hpp"
 #include "physics/timestep.hpp"
 
 #include <asio/asio.hpp>
 
-#include <array>
-#include <list>
 #include <mutex>
 #include <optional>
-#include <unordered_map>
 #include <vector>
 
 namespace App
@@ -19,17 +17,19 @@ namespace App
 	{
 	public:
 		std::optional<int> getPlayerId(const asio::ip::udp::endpoint& endpoint) const;
-		bool isPlayerIdValid(int playerId) const;
 		std::optional<int> addNewPlayer(const asio::ip::udp::endpoint& endpoint,
 			const Physics::Timestep& timestep);
 		void bumpPlayer(int playerId, const Physics::Timestep& timestep);
 		std::vector<int> kickPlayers(const Physics::Timestep& timestep);
-		std::unordered_map<int, PlayerData> getPlayers() const;
+		void getPlayers(PlayerSlots<PlayerData>& players) const;
 		void killPlayer(int playerId, const Physics::Timestep& timestep);
+		void restorePlayer(int playerId, const PlayerData& playerData);
+		unsigned long long getUnverifiedKickCount() const;
 
 	private:
-		std::unordered_map<int, PlayerData> m_players{};
+		PlayerSlots<PlayerData> m_players{};
 		int m_idCounter = 0;
+		unsigned long long m_unverifiedKickCount{};
 		mutable std::mutex m_mutex{};
 
 		std::optional<int> getAvailableId();
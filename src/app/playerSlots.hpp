@@ -0,0 +1,73 @@
+#pragma once
+
+#include "common/config.hpp"
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+
+namespace App
+{
+	template <typename T>
+	class PlayerSlots
+	{
+	public:
+		bool contains(int playerId) const;
+		T& at(int playerId);
+		const T& at(int playerId) const;
+		void insert(int playerId, const T& value);
+		void erase(int playerId);
+
+		template <typename Function>
+		void forEach(Function function) const;
+
+	private:
+		std::bitset<Common::maxPlayerCount> m_active{};
+		std::array<T, Common::maxPlayerCount> m_values{};
+	};
+
+	template <typename T>
+	bool PlayerSlots<T>::contains(int playerId) const
+	{
+		return playerId >= 0 && static_cast<std::size_t>(playerId) < Common::maxPlayerCount &&
+			m_active.test(static_cast<std::size_t>(playerId));
+	}
+
+	template <typename T>
+	T& PlayerSlots<T>::at(int playerId)
+	{
+		return m_values[static_cast<std::size_t>(playerId)];
+	}
+
+	template <typename T>
+	const T& PlayerSlots<T>::at(int playerId) const
+	{
+		return m_values[static_cast<std::size_t>(playerId)];
+	}
+
+	template <typename T>
+	void PlayerSlots<T>::insert(int playerId, const T& value)
+	{
+		m_values[static_cast<std::size_t>(playerId)] = value;
+		m_active.set(static_cast<std::size_t>(playerId));
+	}
+
+	template <typename T>
+	void PlayerSlots<T>::erase(int playerId)
+	{
+		m_active.reset(static_cast<std::size_t>(playerId));
+	}
+
+	template <typename T>
+	template <typename Function>
+	void PlayerSlots<T>::forEach(Function function) const
+	{
+		for (std::size_t slot = 0; slot < Common::maxPlayerCount; ++slot)
+		{
+			if (m_active.test(slot))
+			{
+				function(static_cast<int>(slot), m_values[slot]);
+			}
+		}
+	}
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "common/config.hpp"
+
+namespace App
+{
+	inline constexpr bool pipelinedStateBroadcast = true;
+	inline constexpr int checkpointIntervalSeconds = 5;
+
+	inline constexpr float newPlayersPerSecond = static_cast<float>(Common::maxPlayerCount) / 20;
+	inline constexpr float newPlayerBurst = 4;
+};
@@ -0,0 +1,91 @@
+#include "app/snapshotQueue.hpp"
+
+#include "physics/playerInfo.hpp"
+#include "physics/timestep.hpp"
+
+#include <asio/asio.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace App
+{
+	void SnapshotQueue::push(const asio::ip::udp::endpoint& endpoint, int playerId,
+		const Physics::Timestep& timestep)
+	{
+		m_mutex.lock();
+
+		std::vector<Request>::iterator request = std::find_if(m_requests.begin(),
+			m_requests.end(),
+			[&endpoint] (const Request& queuedRequest)
+			{
+				return queuedRequest.endpoint == endpoint;
+			});
+		if (request == m_requests.end())
+		{
+			m_requests.push_back(Request{endpoint, playerId, timestep});
+		}
+		else
+		{
+			request->playerId = playerId;
+			if (timestep > request->timestep)
+			{
+				request->timestep = timestep;
+			}
+		}
+
+		m_mutex.unlock();
+	}
+
+	bool SnapshotQueue::hasReady(const Physics::Timestep& timestep) const
+	{
+		m_mutex.lock();
+
+		bool ready = std::any_of(m_requests.begin(), m_requests.end(),
+			[&timestep] (const Request& request)
+			{
+				return !(timestep < request.timestep);
+			});
+
+		m_mutex.unlock();
+
+		return ready;
+	}
+
+	std::vector<asio::ip::udp::endpoint> SnapshotQueue::popReady(
+		const Physics::Timestep& timestep,
+		const std::unordered_map<int, Physics::PlayerInfo>& playerInfos)
+	{
+		static const Physics::Timestep expiry{1, 0};
+
+		m_mutex.lock();
+
+		std::vector<asio::ip::udp::endpoint> endpoints{};
+		std::vector<Request>::iterator request = m_requests.begin();
+		while (request != m_requests.end())
+		{
+			if (timestep < request->timestep)
+			{
+				++request;
+			}
+			else if (playerInfos.contains(request->playerId))
+			{
+				endpoints.push_back(request->endpoint);
+				request = m_requests.erase(request);
+			}
+			else if (timestep > request->timestep + expiry)
+			{
+				request = m_requests.erase(request);
+			}
+			else
+			{
+				++request;
+			}
+		}
+
+		m_mutex.unlock();
+
+		return endpoints;
+	}
+};
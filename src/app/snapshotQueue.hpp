@@ -0,0 +1,34 @@
+#pragma once
+
+#include "physics/playerInfo.hpp"
+#include "physics/timestep.hpp"
+
+#include <asio/asio.hpp>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace App
+{
+	class SnapshotQueue
+	{
+	public:
+		void push(const asio::ip::udp::endpoint& endpoint, int playerId,
+			const Physics::Timestep& timestep);
+		bool hasReady(const Physics::Timestep& timestep) const;
+		std::vector<asio::ip::udp::endpoint> popReady(const Physics::Timestep& timestep,
+			const std::unordered_map<int, Physics::PlayerInfo>& playerInfos);
+
+	private:
+		struct Request
+		{
+			asio::ip::udp::endpoint endpoint;
+			int playerId{};
+			Physics::Timestep timestep{};
+		};
+
+		std::vector<Request> m_requests{};
+		mutable std::mutex m_mutex{};
+	};
+};
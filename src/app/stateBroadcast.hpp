@@ -0,0 +1,21 @@
+#pragma once
+
+#include "physics/playerInfo.hpp"
+#include "physics/timestep.hpp"
+
+#include <asio/asio.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace App
+{
+	struct StateBroadcast
+	{
+		Physics::Timestep timestep{};
+		bool killCheck{};
+		bool broadcast{};
+		std::unordered_map<int, Physics::PlayerInfo> playerInfos{};
+		std::vector<asio::ip::udp::endpoint> snapshotEndpoints{};
+	};
+};
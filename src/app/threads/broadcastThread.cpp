@@ -0,0 +1,146 @@
+#include "app/threads/broadcastThread.hpp"
+
+#include "app/checkpoint.hpp"
+#include "app/exitSignal.hpp"
+#include "app/playerManager.hpp"
+#include "app/serverConfig.hpp"
+#include "app/stateBroadcast.hpp"
+#include "app/udp/udpCommunication.hpp"
+#include "common/mapName.hpp"
+#include "physics/playerInfo.hpp"
+#include "physics/simulationClock.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace App
+{
+	BroadcastThread::BroadcastThread(ExitSignal& exitSignal, UDPCommunication& udpCommunication,
+		PlayerManager& playerManager, const Physics::SimulationClock& simulationClock,
+		Common::MapName mapName, const std::string& checkpointPath) :
+		m_exitSignal{exitSignal},
+		m_udpCommunication{udpCommunication},
+		m_playerManager{playerManager},
+		m_simulationClock{simulationClock},
+		m_mapName{mapName},
+		m_checkpointPath{checkpointPath},
+		m_checkpointTime{std::chrono::steady_clock::now()}
+	{
+		if constexpr (pipelinedStateBroadcast)
+		{
+			m_thread = std::thread
+			{
+				[this]
+				{
+					this->mainLoop();
+				}
+			};
+		}
+	}
+
+	void BroadcastThread::push(StateBroadcast& stateBroadcast)
+	{
+		if constexpr (!pipelinedStateBroadcast)
+		{
+			send(stateBroadcast);
+		}
+		else
+		{
+			m_mutex.lock();
+
+			if (m_pending)
+			{
+				stateBroadcast.killCheck =
+					stateBroadcast.killCheck || m_pendingStateBroadcast.killCheck;
+				stateBroadcast.broadcast =
+					stateBroadcast.broadcast || m_pendingStateBroadcast.broadcast;
+				stateBroadcast.snapshotEndpoints.insert(stateBroadcast.snapshotEndpoints.end(),
+					m_pendingStateBroadcast.snapshotEndpoints.begin(),
+					m_pendingStateBroadcast.snapshotEndpoints.end());
+			}
+			std::swap(m_pendingStateBroadcast, stateBroadcast);
+			m_pending = true;
+
+			m_mutex.unlock();
+
+			m_conditionVariable.notify_one();
+		}
+	}
+
+	void BroadcastThread::join()
+	{
+		if (m_thread.joinable())
+		{
+			m_thread.join();
+		}
+	}
+
+	void BroadcastThread::mainLoop()
+	{
+		static constexpr std::chrono::milliseconds timeout{100};
+
+		while (!m_exitSignal.shouldStop())
+		{
+			std::unique_lock<std::mutex> lock{m_mutex};
+			if (!m_conditionVariable.wait_for(lock, timeout, [this] { return m_pending; }))
+			{
+				continue;
+			}
+			std::swap(m_stateBroadcast, m_pendingStateBroadcast);
+			m_pending = false;
+			lock.unlock();
+
+			send(m_stateBroadcast);
+		}
+	}
+
+	void BroadcastThread::send(const StateBroadcast& stateBroadcast)
+	{
+		if (stateBroadcast.killCheck)
+		{
+			for (const std::pair<const int, Physics::PlayerInfo>& playerInfo :
+				stateBroadcast.playerInfos)
+			{
+				if (playerInfo.second.state.hp == 0)
+				{
+					m_playerManager.killPlayer(playerInfo.first, stateBroadcast.timestep);
+				}
+			}
+		}
+
+		if (stateBroadcast.broadcast)
+		{
+			m_playerManager.getPlayers(m_players);
+			m_udpCommunication.broadcastStateFrame(m_players, stateBroadcast.timestep,
+				stateBroadcast.playerInfos);
+			saveCheckpointIfDue(stateBroadcast);
+		}
+		else if (!stateBroadcast.snapshotEndpoints.empty())
+		{
+			m_udpCommunication.sendStateFrame(stateBroadcast.snapshotEndpoints,
+				stateBroadcast.timestep, stateBroadcast.playerInfos);
+		}
+	}
+
+	void BroadcastThread::saveCheckpointIfDue(const StateBroadcast& stateBroadcast)
+	{
+		static constexpr std::chrono::seconds checkpointInterval{checkpointIntervalSeconds};
+
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if (m_checkpointPath.empty() || now - m_checkpointTime < checkpointInterval)
+		{
+			return;
+		}
+		m_checkpointTime = now;
+
+		if (!saveCheckpoint(m_checkpointPath, m_mapName, m_simulationClock,
+			stateBroadcast.timestep, stateBroadcast.playerInfos, m_players))
+		{
+			std::cout << "Failed to save checkpoint to " << m_checkpointPath << std::endl;
+		}
+	}
+};
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "app/exitSignal.hpp"
+#include "app/playerData.hpp"
+#include "app/playerManager.hpp"
+#include "app/playerSlots.hpp"
+#include "app/stateBroadcast.hpp"
+#include "app/udp/udpCommunication.hpp"
+#include "common/mapName.hpp"
+#include "physics/simulationClock.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace App
+{
+	class BroadcastThread
+	{
+	public:
+		BroadcastThread(ExitSignal& exitSignal, UDPCommunication& udpCommunication,
+			PlayerManager& playerManager, const Physics::SimulationClock& simulationClock,
+			Common::MapName mapName, const std::string& checkpointPath);
+		void push(StateBroadcast& stateBroadcast);
+		void join();
+
+	private:
+		ExitSignal& m_exitSignal;
+
+		UDPCommunication& m_udpCommunication;
+
+		PlayerManager& m_playerManager;
+		PlayerSlots<PlayerData> m_players{};
+
+		const Physics::SimulationClock& m_simulationClock;
+		const Common::MapName m_mapName;
+		const std::string m_checkpointPath;
+		std::chrono::steady_clock::time_point m_checkpointTime{};
+
+		StateBroadcast m_pendingStateBroadcast{};
+		bool m_pending = false;
+		StateBroadcast m_stateBroadcast{};
+		std::mutex m_mutex{};
+		std::condition_variable m_conditionVariable{};
+
+		std::thread m_thread;
+
+		void mainLoop();
+		void send(const StateBroadcast& stateBroadcast);
+		void saveCheckpointIfDue(const StateBroadcast& stateBroadcast);
+	};
+};
@@ -1,8 +1,17 @@
 #include "app/threads/networkThread.hpp"
 
+#include "app/checkpoint.hpp"
 #include "app/exitCode.hpp"
 #include "app/exitSignal.hpp"
+#include "app/inputPredictor.hpp"
+#include "app/overloadController.hpp"
+#include "app/overloadStage.hpp"
+#include "app/playerData.hpp"
+#include "app/snapshotQueue.hpp"
+#include "app/tokenBucket.hpp"
+#include "app/threads/broadcastThread.hpp"
 #include "app/threads/physicsThread.hpp"
+#include "app/udp/admissionStats.hpp"
 #include "app/udp/udpCommunication.hpp"
 #include "app/udp/udpFrameType.hpp"
 #include "common/airplaneTypeName.hpp"
@@ -20,6 +29,9 @@
 #include <asio/asio.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
 #include <memory>
 #include <optional>
 #include <semaphore>
@@ -32,20 +44,26 @@
 namespace App
 {
 	NetworkThread::NetworkThread(ExitSignal& exitSignal, Common::MapName mapName,
-		int networkThreadPort, int physicsThreadPort) :
+		int networkThreadPort, int physicsThreadPort, const std::string& checkpointPath) :
 		m_exitSignal{exitSignal},
+		m_mapName{mapName},
 		m_simulationBuffer{-1, mapName},
 		m_spawner{*Common::Terrains::maps[toSizeT(mapName)]},
-		m_udpCommunication{networkThreadPort, physicsThreadPort}
+		m_udpCommunication{networkThreadPort, physicsThreadPort},
+		m_checkpointPath{checkpointPath}
 	{ }
 
 	void NetworkThread::start()
 	{
+		restoreCheckpoint();
 		m_frameCutoff = m_simulationClock.getTime();
+		BroadcastThread broadcastThread{m_exitSignal, m_udpCommunication, m_playerManager,
+			m_simulationClock, m_mapName, m_checkpointPath};
 		PhysicsThread physicsThread{m_exitSignal, m_simulationClock, m_simulationBuffer,
-			m_notification, m_udpCommunication, m_playerManager};
+			m_notification, broadcastThread, m_snapshotQueue, m_overloadController};
 		mainLoop();
 		physicsThread.join();
+		broadcastThread.join();
 	}
 
 	void NetworkThread::mainLoop()
@@ -53,6 +71,7 @@ namespace App
 		while (!m_exitSignal.shouldStop())
 		{
 			kickPlayers();
+			reportStats();
 
 			asio::ip::udp::endpoint endpoint{};
 			Physics::Timestamp clientTimestamp{};
@@ -65,9 +84,8 @@ namespace App
 			bool received = m_udpCommunication.receiveInitReqOrControlFrame(endpoint,
 				clientTimestamp, udpFrameType, airplaneTypeName, timestep, playerId, playerInput);
 			
-			static constexpr Physics::Timestep frameAgeCutoffOffset{0,
-				static_cast<unsigned int>(Common::stepsPerSecond * 0.9f)};
-			Physics::Timestep frameAgeCutoff = m_simulationClock.getTime() - frameAgeCutoffOffset;
+			Physics::Timestep frameAgeCutoff =
+				m_simulationClock.getTime() - m_overloadController.getRollbackWindow();
 			if (m_frameCutoff < frameAgeCutoff)
 			{
 				m_frameCutoff = frameAgeCutoff;
@@ -84,11 +102,75 @@ namespace App
 			}
 			else if (udpFrameType == UDPFrameType::control && timestep > m_frameCutoff)
 			{
-				handleControlFrame(clientTimestamp, timestep, playerId, playerInput);
+				handleControlFrame(endpoint, clientTimestamp, timestep, playerId, playerInput);
 			}
 		}
 	}
 
+	void NetworkThread::restoreCheckpoint()
+	{
+		if (m_checkpointPath.empty())
+		{
+			return;
+		}
+		if (!std::filesystem::exists(m_checkpointPath))
+		{
+			std::cout << "No checkpoint at " << m_checkpointPath << ", starting a new match" <<
+				std::endl;
+			return;
+		}
+
+		Checkpoint checkpoint{};
+		if (!loadCheckpoint(m_checkpointPath, checkpoint))
+		{
+			std::cout << "Ignoring checkpoint " << m_checkpointPath <<
+				": file is unreadable, corrupt or from another format version" << std::endl;
+			return;
+		}
+		if (checkpoint.mapName != m_mapName)
+		{
+			std::cout << "Ignoring checkpoint " << m_checkpointPath << ": it was saved on map " <<
+				Common::toSizeT(checkpoint.mapName) << ", but the server runs map " <<
+				Common::toSizeT(m_mapName) << std::endl;
+			return;
+		}
+
+		Physics::Timestep timestep = m_simulationClock.getTime();
+		if (!rebaseCheckpoint(checkpoint, timestep, std::chrono::system_clock::now()))
+		{
+			std::cout << "Ignoring checkpoint " << m_checkpointPath <<
+				": it was saved later than the current system time" << std::endl;
+			return;
+		}
+
+		int restoredPlayerCount = 0;
+		checkpoint.players.forEach
+		(
+			[this, &checkpoint, &timestep, &restoredPlayerCount]
+			(int playerId, const PlayerData& playerData)
+			{
+				std::unordered_map<int, Physics::PlayerInfo>::const_iterator playerInfo =
+					checkpoint.playerInfos.find(playerId);
+				if (playerInfo == checkpoint.playerInfos.end())
+				{
+					return;
+				}
+
+				m_playerManager.restorePlayer(playerId, playerData);
+				m_simulationBuffer.writeInitFrame(timestep, playerId, playerInfo->second);
+				m_inputPredictor.reset(playerId, timestep, playerInfo->second.input);
+				m_snapshotQueue.push(playerData.endpoint, playerId, timestep);
+				++restoredPlayerCount;
+			}
+		);
+		if (restoredPlayerCount > 0)
+		{
+			m_notification.setNotification(timestep, false);
+		}
+		std::cout << "Restored " << restoredPlayerCount << " players from checkpoint " <<
+			m_checkpointPath << std::endl;
+	}
+
 	void NetworkThread::kickPlayers()
 	{
 		Physics::Timestep timestep = m_simulationClock.getTime();	
@@ -96,10 +178,52 @@ namespace App
 		if (!kickedPlayers.empty())
 		{
 			m_simulationBuffer.kickPlayers(kickedPlayers, timestep);
+			for (int kickedPlayer : kickedPlayers)
+			{
+				m_inputPredictor.erase(kickedPlayer);
+			}
 			m_notification.setNotification(timestep, false);
 		}
 	}
 
+	void NetworkThread::reportStats()
+	{
+		static const Physics::Timestep reportInterval{60, 0};
+		Physics::Timestep timestep = m_simulationClock.getTime();
+		if (timestep < m_statsReportTimestep)
+		{
+			return;
+		}
+		m_statsReportTimestep = timestep + reportInterval;
+
+		AdmissionStats admissionStats = m_udpCommunication.getAdmissionStats();
+		unsigned long long unverifiedKickCount = m_playerManager.getUnverifiedKickCount();
+		if (admissionStats.rejectedType + admissionStats.rejectedSize +
+			admissionStats.rejectedRate + admissionStats.rejectedEndpointLimit +
+			m_rejectedSenderCount + m_rejectedNewPlayerCount + m_refusedJoinCount +
+			unverifiedKickCount > 0)
+		{
+			std::cout << "Rejected frames: type " << admissionStats.rejectedType <<
+				", size " << admissionStats.rejectedSize <<
+				", rate " << admissionStats.rejectedRate <<
+				", endpoint limit " << admissionStats.rejectedEndpointLimit <<
+				", sender " << m_rejectedSenderCount <<
+				", new player " << m_rejectedNewPlayerCount <<
+				", refused join " << m_refusedJoinCount <<
+				", unverified join " << unverifiedKickCount << std::endl;
+		}
+
+		unsigned long long predictionHitCount = m_inputPredictor.getHitCount();
+		unsigned long long predictionCount = predictionHitCount + m_inputPredictor.getMissCount();
+		if (predictionCount > 0)
+		{
+			std::cout << "Input prediction hit rate: " <<
+				100.0 * static_cast<double>(predictionHitCount) /
+				static_cast<double>(predictionCount) << "% of " << predictionCount <<
+				" control frames" << std::endl;
+		}
+	}
+
 	void NetworkThread::handleInitReqFrame(const asio::ip::udp::endpoint& endpoint,
 		const Physics::Timestamp& clientTimestamp, const Common::AirplaneTypeName& airplaneTypeName)
 	{
@@ -107,9 +231,22 @@ namespace App
 		if (playerId)
 		{
 			m_udpCommunication.sendInitResFrame(endpoint, clientTimestamp, *playerId);
+			m_snapshotQueue.push(endpoint, *playerId, m_simulationClock.getTime());
 		}
 		else
 		{
+			if (m_overloadController.getStage() == OverloadStage::refusingJoins)
+			{
+				++m_refusedJoinCount;
+				return;
+			}
+
+			if (!m_newPlayerBucket.take(std::chrono::steady_clock::now()))
+			{
+				++m_rejectedNewPlayerCount;
+				return;
+			}
+
 			Physics::Timestep timestep = m_simulationClock.getTime();
 			playerId = m_playerManager.addNewPlayer(endpoint, timestep);
 			if (playerId)
@@ -125,23 +262,31 @@ namespace App
 					}
 				};
 				m_simulationBuffer.writeInitFrame(timestep, *playerId, playerInfo);
+				m_inputPredictor.reset(*playerId, timestep, playerInfo.input);
 				m_notification.setNotification(timestep, false);
 				m_udpCommunication.sendInitResFrame(endpoint, clientTimestamp, *playerId);
+				m_snapshotQueue.push(endpoint, *playerId, timestep);
 			}
 		}
 	}
 
-	void NetworkThread::handleControlFrame(const Physics::Timestamp& clientTimestamp,
-		const Physics::Timestep& timestep, int playerId, const Physics::PlayerInput& playerInput)
+	void NetworkThread::handleControlFrame(const asio::ip::udp::endpoint& endpoint,
+		const Physics::Timestamp& clientTimestamp, const Physics::Timestep& timestep, int playerId,
+		const Physics::PlayerInput& playerInput)
 	{
-		if (!m_playerManager.isPlayerIdValid(playerId))
+		if (m_playerManager.getPlayerId(endpoint) != playerId)
 		{
+			++m_rejectedSenderCount;
 			return;
 		}
 		m_simulationBuffer.writeControlFrame(timestep, playerId, playerInput);
-				m_notification.setNotification(timestep, false);
-		m_udpCommunication.broadcastControlFrame(m_playerManager.getPlayers(),
-			clientTimestamp, timestep, playerId, playerInput);
+		if (!m_inputPredictor.matchesPrediction(playerId, timestep, playerInput))
+		{
+			m_notification.setNotification(timestep, false);
+		}
+		m_playerManager.getPlayers(m_players);
+		m_udpCommunication.broadcastControlFrame(m_players, clientTimestamp, timestep, playerId,
+			playerInput);
 		m_playerManager.bumpPlayer(playerId, m_simulationClock.getTime());
 	}
 };
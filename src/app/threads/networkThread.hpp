@@ -1,7 +1,14 @@
 #pragma once
 
 #include "app/exitSignal.hpp"
+#include "app/inputPredictor.hpp"
+#include "app/overloadController.hpp"
+#include "app/playerData.hpp"
 #include "app/playerManager.hpp"
+#include "app/playerSlots.hpp"
+#include "app/serverConfig.hpp"
+#include "app/snapshotQueue.hpp"
+#include "app/tokenBucket.hpp"
 #include "app/udp/udpCommunication.hpp"
 #include "common/mapName.hpp"
 #include "physics/notification.hpp"
@@ -9,6 +16,7 @@
 #include "physics/simulationClock.hpp"
 #include "physics/spawner.hpp"
 
+#include <string>
 #include <unordered_map>
 
 namespace App
@@ -17,12 +25,13 @@ namespace App
 	{
 	public:
 		NetworkThread(ExitSignal& exitSignal, Common::MapName mapName, int networkThreadPort,
-			int physicsThreadPort);
+			int physicsThreadPort, const std::string& checkpointPath);
 		void start();
 
 	private:
 		ExitSignal& m_exitSignal;
 
+		const Common::MapName m_mapName;
 		Physics::SimulationClock m_simulationClock{};
 		Physics::SimulationBuffer m_simulationBuffer;
 		Physics::Spawner m_spawner;
@@ -30,16 +39,30 @@ namespace App
 		Physics::Notification m_notification{m_simulationClock};
 		Physics::Timestep m_frameCutoff{};
 		UDPCommunication m_udpCommunication;
+		unsigned long long m_rejectedSenderCount{};
+		TokenBucket m_newPlayerBucket{newPlayersPerSecond, newPlayerBurst};
+		unsigned long long m_rejectedNewPlayerCount{};
+		unsigned long long m_refusedJoinCount{};
+		InputPredictor m_inputPredictor{};
+		Physics::Timestep m_statsReportTimestep{};
+
+		const std::string m_checkpointPath;
 
 		PlayerManager m_playerManager{};
+		PlayerSlots<PlayerData> m_players{};
+		SnapshotQueue m_snapshotQueue{};
+		OverloadController m_overloadController{};
 
 		void mainLoop();
 
+		void restoreCheckpoint();
 		void kickPlayers();
+		void reportStats();
 		void handleInitReqFrame(const asio::ip::udp::endpoint& endpoint,
 			const Physics::Timestamp& clientTimestamp,
 			const Common::AirplaneTypeName& airplaneTypeName);
-		void handleControlFrame(const Physics::Timestamp& clientTimestamp,
+		void handleControlFrame(const asio::ip::udp::endpoint& endpoint,
+			const Physics::Timestamp& clientTimestamp,
 			const Physics::Timestep& timestep, int playerId,
 			const Physics::PlayerInput& playerInput);
 	};
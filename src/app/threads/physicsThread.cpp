@@ -1,8 +1,11 @@
 #include "app/threads/physicsThread.hpp"
 
 #include "app/exitSignal.hpp"
-#include "app/playerManager.hpp"
-#include "app/udp/udpCommunication.hpp"
+#include "app/overloadController.hpp"
+#include "app/overloadStage.hpp"
+#include "app/snapshotQueue.hpp"
+#include "app/stateBroadcast.hpp"
+#include "app/threads/broadcastThread.hpp"
 #include "common/airplaneInfo.hpp"
 #include "physics/notification.hpp"
 #include "physics/playerInput.hpp"
@@ -10,20 +13,26 @@
 #include "physics/simulationClock.hpp"
 #include "physics/timestep.hpp"
 
+#include <asio/asio.hpp>
+
+#include <iostream>
 #include <thread>
+#include <vector>
 
 namespace App
 {
 	PhysicsThread::PhysicsThread(ExitSignal& exitSignal,
 		const Physics::SimulationClock& simulationClock,
 		Physics::SimulationBuffer& simulationBuffer, Physics::Notification& notification,
-		UDPCommunication& udpCommunication, PlayerManager& playerManager) :
+		BroadcastThread& broadcastThread, SnapshotQueue& snapshotQueue,
+		OverloadController& overloadController) :
 		m_exitSignal{exitSignal},
 		m_simulationClock{simulationClock},
 		m_simulationBuffer{simulationBuffer},
 		m_notification{notification},
-		m_udpCommunication{udpCommunication},
-		m_playerManager{playerManager},
+		m_broadcastThread{broadcastThread},
+		m_snapshotQueue{snapshotQueue},
+		m_overloadController{overloadController},
 		m_thread
 		{
 			[this]
@@ -50,6 +59,7 @@ namespace App
 	void PhysicsThread::mainLoop(const Physics::Timestep& initialTimestep)
 	{
 		Physics::Timestep timestep = initialTimestep;
+		Physics::Timestep newestTimestep = initialTimestep;
 		while (!m_exitSignal.shouldStop())
 		{
 			timestep = timestep.next();
@@ -58,20 +68,31 @@ namespace App
 
 			m_simulationBuffer.update(timestep);
 
-			if (timestep.step == 0)
+			bool newest = timestep > newestTimestep;
+			if (newest)
+			{
+				newestTimestep = timestep;
+				updateOverloadStage(timestep);
+			}
+
+			bool killCheck = newest && timestep.step == 0;
+			bool broadcast = killCheck && m_overloadController.shouldBroadcastState();
+			if (!killCheck && !m_snapshotQueue.hasReady(timestep))
+			{
+				continue;
+			}
+
+			m_stateBroadcast.timestep = timestep;
+			m_stateBroadcast.killCheck = killCheck;
+			m_stateBroadcast.broadcast = broadcast;
+			m_stateBroadcast.playerInfos = m_simulationBuffer.getPlayerInfos(timestep);
+			m_stateBroadcast.snapshotEndpoints =
+				m_snapshotQueue.popReady(timestep, m_stateBroadcast.playerInfos);
+			if (!killCheck && m_stateBroadcast.snapshotEndpoints.empty())
 			{
-				std::unordered_map<int, Physics::PlayerInfo> playerInfos =
-					m_simulationBuffer.getPlayerInfos(timestep);
-				for (const std::pair<const int, Physics::PlayerInfo>& playerInfo : playerInfos)
-				{
-					if (playerInfo.second.state.hp == 0)
-					{
-						m_playerManager.killPlayer(playerInfo.first, timestep);
-					}
-				}
-				m_udpCommunication.broadcastStateFrame(m_playerManager.getPlayers(), timestep,
-					playerInfos);
+				continue;
 			}
+			m_broadcastThread.push(m_stateBroadcast);
 		}
 	}
 
@@ -83,4 +104,14 @@ namespace App
 			currentTimestep = m_simulationClock.getTime();
 		}
 	}
+
+	void PhysicsThread::updateOverloadStage(const Physics::Timestep& timestep)
+	{
+		bool behind = m_simulationClock.getTime() > timestep.next();
+		if (m_overloadController.update(behind))
+		{
+			std::cout << "Overload stage: " << toString(m_overloadController.getStage()) <<
+				std::endl;
+		}
+	}
 };
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "app/exitSignal.hpp"
-#include "app/playerManager.hpp"
-#include "app/udp/udpCommunication.hpp"
+#include "app/overloadController.hpp"
+#include "app/snapshotQueue.hpp"
+#include "app/stateBroadcast.hpp"
+#include "app/threads/broadcastThread.hpp"
 #include "physics/notification.hpp"
 #include "physics/simulationBuffer.hpp"
 #include "physics/simulationClock.hpp"
@@ -17,23 +19,28 @@ namespace App
 	public:
 		PhysicsThread(ExitSignal& exitSignal, const Physics::SimulationClock& simulationClock,
 			Physics::SimulationBuffer& simulationBuffer, Physics::Notification& notification,
-			UDPCommunication& udpCommunication, PlayerManager& playerManager);
+			BroadcastThread& broadcastThread, SnapshotQueue& snapshotQueue,
+			OverloadController& overloadController);
 		void join();
 
 	private:
-		std::thread m_thread;
 		ExitSignal& m_exitSignal;
 
 		const Physics::SimulationClock& m_simulationClock;
 		Physics::SimulationBuffer& m_simulationBuffer;
 		Physics::Notification& m_notification;
 
-		UDPCommunication& m_udpCommunication;
+		BroadcastThread& m_broadcastThread;
+		StateBroadcast m_stateBroadcast{};
+
+		SnapshotQueue& m_snapshotQueue;
+		OverloadController& m_overloadController;
 
-		PlayerManager& m_playerManager;
+		std::thread m_thread;
 
 		void start();
 		void mainLoop(const Physics::Timestep& initialTimestep);
 		void sleepIfFuture(const Physics::Timestep& timestep);
+		void updateOverloadStage(const Physics::Timestep& timestep);
 	};
 };
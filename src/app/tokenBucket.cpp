@@ -0,0 +1,30 @@
+#include "app/tokenBucket.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace App
+{
+	TokenBucket::TokenBucket(float tokensPerSecond, float capacity) :
+		m_tokensPerSecond{tokensPerSecond},
+		m_capacity{capacity},
+		m_tokens{capacity}
+	{ }
+
+	bool TokenBucket::take(const std::chrono::steady_clock::time_point& now)
+	{
+		if (m_lastRefill != std::chrono::steady_clock::time_point{})
+		{
+			std::chrono::duration<float> elapsed = now - m_lastRefill;
+			m_tokens = std::min(m_capacity, m_tokens + elapsed.count() * m_tokensPerSecond);
+		}
+		m_lastRefill = now;
+
+		if (m_tokens < 1)
+		{
+			return false;
+		}
+		m_tokens -= 1;
+		return true;
+	}
+};
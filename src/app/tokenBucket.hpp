@@ -0,0 +1,19 @@
+#pragma once
+
+#include <chrono>
+
+namespace App
+{
+	class TokenBucket
+	{
+	public:
+		TokenBucket(float tokensPerSecond, float capacity);
+		bool take(const std::chrono::steady_clock::time_point& now);
+
+	private:
+		float m_tokensPerSecond{};
+		float m_capacity{};
+		float m_tokens{};
+		std::chrono::steady_clock::time_point m_lastRefill{};
+	};
+};
@@ -0,0 +1,110 @@
+#include "app/udp/admissionControl.hpp"
+
+#include "app/tokenBucket.hpp"
+#include "app/udp/admissionStats.hpp"
+#include "app/udp/udpFrameType.hpp"
+#include "app/udp/udpSerializer.hpp"
+#include "common/airplaneTypeName.hpp"
+#include "common/config.hpp"
+#include "physics/playerInput.hpp"
+#include "physics/timestamp.hpp"
+#include "physics/timestep.hpp"
+
+#include <asio/asio.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <map>
+#include <vector>
+
+namespace App
+{
+	AdmissionControl::AdmissionControl()
+	{
+		std::vector<std::uint8_t> buffer{};
+		UDPSerializer::serializeInitReqFrame(Physics::Timestamp{}, Common::AirplaneTypeName{},
+			buffer);
+		m_initReqFrameSize = buffer.size();
+
+		buffer.clear();
+		UDPSerializer::serializeControlFrame(Physics::Timestamp{}, Physics::Timestamp{},
+			Physics::Timestep{}, 0, Physics::PlayerInput{}, buffer);
+		m_controlFrameSize = buffer.size();
+	}
+
+	bool AdmissionControl::admit(const asio::ip::udp::endpoint& endpoint,
+		std::uint8_t frameType, std::size_t frameSize)
+	{
+		std::size_t expectedFrameSize{};
+		if (frameType == toUInt8(UDPFrameType::initReq))
+		{
+			expectedFrameSize = m_initReqFrameSize;
+		}
+		else if (frameType == toUInt8(UDPFrameType::control))
+		{
+			expectedFrameSize = m_controlFrameSize;
+		}
+		else
+		{
+			++m_stats.rejectedType;
+			return false;
+		}
+
+		if (frameSize != expectedFrameSize)
+		{
+			++m_stats.rejectedSize;
+			return false;
+		}
+
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		EndpointBuckets* endpointBuckets = getEndpointBuckets(endpoint, now);
+		if (!endpointBuckets)
+		{
+			++m_stats.rejectedEndpointLimit;
+			return false;
+		}
+
+		bool admitted = frameType == toUInt8(UDPFrameType::initReq) ?
+			endpointBuckets->initReq.take(now) : endpointBuckets->control.take(now);
+		if (!admitted)
+		{
+			++m_stats.rejectedRate;
+		}
+		return admitted;
+	}
+
+	AdmissionStats AdmissionControl::getStats() const
+	{
+		return m_stats;
+	}
+
+	AdmissionControl::EndpointBuckets* AdmissionControl::getEndpointBuckets(
+		const asio::ip::udp::endpoint& endpoint, const std::chrono::steady_clock::time_point& now)
+	{
+		std::map<asio::ip::udp::endpoint, EndpointBuckets>::iterator endpointBuckets =
+			m_endpoints.find(endpoint);
+		if (endpointBuckets != m_endpoints.end())
+		{
+			m_recency.splice(m_recency.end(), m_recency, endpointBuckets->second.recency);
+			return &endpointBuckets->second;
+		}
+
+		if (m_endpoints.size() >= maxEndpointCount)
+		{
+			if (!m_evictionBucket.take(now))
+			{
+				return nullptr;
+			}
+			m_endpoints.erase(m_recency.front());
+			m_recency.pop_front();
+		}
+
+		m_recency.push_back(endpoint);
+		EndpointBuckets& newEndpointBuckets = m_endpoints[endpoint];
+		newEndpointBuckets.recency = std::prev(m_recency.end());
+		return &newEndpointBuckets;
+	}
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "app/tokenBucket.hpp"
+#include "app/udp/admissionStats.hpp"
+#include "common/config.hpp"
+
+#include <asio/asio.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+
+namespace App
+{
+	class AdmissionControl
+	{
+	public:
+		AdmissionControl();
+		bool admit(const asio::ip::udp::endpoint& endpoint, std::uint8_t frameType,
+			std::size_t frameSize);
+		AdmissionStats getStats() const;
+
+	private:
+		static constexpr float initReqTokensPerSecond = 1;
+		static constexpr float initReqCapacity = 3;
+		static constexpr float controlTokensPerSecond = Common::stepsPerSecond * 2.0f;
+		static constexpr float controlCapacity = Common::stepsPerSecond;
+		static constexpr std::size_t maxEndpointCount = 4096;
+
+		struct EndpointBuckets
+		{
+			TokenBucket initReq{initReqTokensPerSecond, initReqCapacity};
+			TokenBucket control{controlTokensPerSecond, controlCapacity};
+			std::list<asio::ip::udp::endpoint>::iterator recency{};
+		};
+
+		std::size_t m_initReqFrameSize{};
+		std::size_t m_controlFrameSize{};
+		std::map<asio::ip::udp::endpoint, EndpointBuckets> m_endpoints{};
+		std::list<asio::ip::udp::endpoint> m_recency{};
+		TokenBucket m_evictionBucket{static_cast<float>(maxEndpointCount),
+			static_cast<float>(maxEndpointCount)};
+		AdmissionStats m_stats{};
+
+		EndpointBuckets* getEndpointBuckets(const asio::ip::udp::endpoint& endpoint,
+			const std::chrono::steady_clock::time_point& now);
+	};
+};
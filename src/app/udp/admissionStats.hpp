@@ -0,0 +1,12 @@
+#pragma once
+
+namespace App
+{
+	struct AdmissionStats
+	{
+		unsigned long long rejectedType{};
+		unsigned long long rejectedSize{};
+		unsigned long long rejectedRate{};
+		unsigned long long rejectedEndpointLimit{};
+	};
+};
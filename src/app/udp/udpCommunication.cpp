@@ -1,6 +1,9 @@
 #include "app/udp/udpCommunication.hpp"
 
 #include "app/playerData.hpp"
+#include "app/playerSlots.hpp"
+#include "app/udp/admissionControl.hpp"
+#include "app/udp/admissionStats.hpp"
 #include "app/udp/udpFrameType.hpp"
 #include "app/udp/udpSerializer.hpp"
 #include "common/airplaneTypeName.hpp"
@@ -42,7 +45,7 @@ namespace App
 	}
 
 	void UDPCommunication::broadcastControlFrame(
-		const std::unordered_map<int, PlayerData>& playerDatas,
+		const PlayerSlots<PlayerData>& playerDatas,
 		const Physics::Timestamp& clientTimestamp, const Physics::Timestep& timestep, int playerId,
 		const Physics::PlayerInput& playerInput)
 	{
@@ -50,22 +53,44 @@ namespace App
 		UDPSerializer::serializeControlFrame(clientTimestamp, Physics::Timestamp::systemNow(),
 			timestep, playerId, playerInput, buffer);
 
-		for (const std::pair<const int, PlayerData>& player : playerDatas)
-		{
-			m_networkThreadSocket.send_to(asio::buffer(buffer), player.second.endpoint);
-		}
+		playerDatas.forEach
+		(
+			[this, &buffer] (int, const PlayerData& playerData)
+			{
+				if (playerData.verified)
+				{
+					m_networkThreadSocket.send_to(asio::buffer(buffer), playerData.endpoint);
+				}
+			}
+		);
 	}
 
 	void UDPCommunication::broadcastStateFrame(
-		const std::unordered_map<int, PlayerData>& playerDatas, const Physics::Timestep& timestep,
+		const PlayerSlots<PlayerData>& playerDatas, const Physics::Timestep& timestep,
+		const std::unordered_map<int, Physics::PlayerInfo>& playerInfos)
+	{
+		std::vector<std::uint8_t> buffer{};
+		UDPSerializer::serializeStateFrame(timestep, playerInfos, buffer);
+
+		playerDatas.forEach
+		(
+			[this, &buffer] (int, const PlayerData& playerData)
+			{
+				m_physicsThreadSocket.send_to(asio::buffer(buffer), playerData.endpoint);
+			}
+		);
+	}
+
+	void UDPCommunication::sendStateFrame(const std::vector<asio::ip::udp::endpoint>& endpoints,
+		const Physics::Timestep& timestep,
 		const std::unordered_map<int, Physics::PlayerInfo>& playerInfos)
 	{
 		std::vector<std::uint8_t> buffer{};
 		UDPSerializer::serializeStateFrame(timestep, playerInfos, buffer);
 
-		for (const std::pair<const int, PlayerData>& player : playerDatas)
+		for (const asio::ip::udp::endpoint& endpoint : endpoints)
 		{
-			m_physicsThreadSocket.send_to(asio::buffer(buffer), player.second.endpoint);
+			m_physicsThreadSocket.send_to(asio::buffer(buffer), endpoint);
 		}
 	}
 
@@ -78,10 +103,12 @@ namespace App
 		return receiveFrameWithTimeout
 		(
 			endpoint,
-			[&clientTimestamp, &udpFrameType, &airplaneTypeName, &timestep, &playerId, &playerInput]
-			(std::vector<std::uint8_t> buffer, std::size_t receivedSize)
+			[this, &endpoint, &clientTimestamp, &udpFrameType, &airplaneTypeName, &timestep,
+				&playerId, &playerInput]
+			(const std::vector<std::uint8_t>& buffer, std::size_t receivedSize)
 			{
-				if (receivedSize == 0)
+				if (receivedSize == 0 ||
+					!m_admissionControl.admit(endpoint, buffer[0], receivedSize))
 				{
 					return false;
 				}
@@ -110,8 +137,13 @@ namespace App
 		);
 	}
 
+	AdmissionStats UDPCommunication::getAdmissionStats() const
+	{
+		return m_admissionControl.getStats();
+	}
+
 	bool UDPCommunication::receiveFrameWithTimeout(asio::ip::udp::endpoint& endpoint,
-		std::function<bool(std::vector<std::uint8_t>, std::size_t)> frameHandler,
+		std::function<bool(const std::vector<std::uint8_t>&, std::size_t)> frameHandler,
 		const std::chrono::seconds& timeout)
 	{
 		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "app/playerData.hpp"
+#include "app/playerSlots.hpp"
+#include "app/udp/admissionControl.hpp"
+#include "app/udp/admissionStats.hpp"
 #include "app/udp/udpFrameType.hpp"
 #include "common/airplaneTypeName.hpp"
 #include "physics/playerInfo.hpp"
@@ -26,10 +29,13 @@ namespace App
 
 		void sendInitResFrame(const asio::ip::udp::endpoint& endpoint,
 			const Physics::Timestamp& clientTimestamp, int playerId);
-		void broadcastControlFrame(const std::unordered_map<int, PlayerData>& playerDatas,
+		void broadcastControlFrame(const PlayerSlots<PlayerData>& playerDatas,
 			const Physics::Timestamp& clientTimestamp, const Physics::Timestep& timestep,
 			int playerId, const Physics::PlayerInput& playerInput);
-		void broadcastStateFrame(const std::unordered_map<int, PlayerData>& playerDatas,
+		void broadcastStateFrame(const PlayerSlots<PlayerData>& playerDatas,
+			const Physics::Timestep& timestep,
+			const std::unordered_map<int, Physics::PlayerInfo>& playerInfos);
+		void sendStateFrame(const std::vector<asio::ip::udp::endpoint>& endpoints,
 			const Physics::Timestep& timestep,
 			const std::unordered_map<int, Physics::PlayerInfo>& playerInfos);
 
@@ -37,6 +43,7 @@ namespace App
 			Physics::Timestamp& clientTimestamp, UDPFrameType& udpFrameType,
 			Common::AirplaneTypeName& airplaneTypeName, Physics::Timestep& timestep, int& playerId,
 			Physics::PlayerInput& playerInput);
+		AdmissionStats getAdmissionStats() const;
 
 	private:
 		asio::io_context m_networkThreadIOContext{};
@@ -45,8 +52,10 @@ namespace App
 		asio::io_context m_physicsThreadIOContext{};
 		asio::ip::udp::socket m_physicsThreadSocket;
 
+		AdmissionControl m_admissionControl{};
+
 		bool receiveFrameWithTimeout(asio::ip::udp::endpoint& endpoint,
-			std::function<bool(std::vector<std::uint8_t>, std::size_t)> frameHandler,
+			std::function<bool(const std::vector<std::uint8_t>&, std::size_t)> frameHandler,
 			const std::chrono::seconds& timeout);
 		void setReceiveSocketTimeout(const std::chrono::duration<float>& timeout);
 		static void completionHandler(std::shared_ptr<std::vector<std::uint8_t>>);
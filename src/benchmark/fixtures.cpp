@@ -0,0 +1,44 @@
+#include "benchmark/fixtures.hpp"
+
+#include "common/airplaneTypeName.hpp"
+#include "common/config.hpp"
+#include "common/terrains/maps/maps.hpp"
+#include "physics/airplaneDefinitions.hpp"
+#include "physics/playerInfo.hpp"
+#include "physics/playerInput.hpp"
+#include "physics/playerState.hpp"
+#include "physics/simulationBuffer.hpp"
+#include "physics/spawner.hpp"
+#include "physics/timestep.hpp"
+
+#include <vector>
+
+namespace Benchmark
+{
+	std::vector<int> getPlayerCounts()
+	{
+		return {1, 8, static_cast<int>(Common::maxPlayerCount)};
+	}
+
+	void addPlayers(Physics::SimulationBuffer& simulationBuffer, const Physics::Timestep& timestep,
+		int playerCount)
+	{
+		Physics::Spawner spawner{*Common::Terrains::maps[Common::toSizeT(benchmarkMapName)]};
+		for (int playerId = 0; playerId < playerCount; ++playerId)
+		{
+			Common::AirplaneTypeName airplaneTypeName{};
+			Physics::PlayerInfo playerInfo
+			{
+				Physics::PlayerInput{},
+				Physics::PlayerState
+				{
+					airplaneTypeName,
+					Physics::airplaneDefinitions[Common::toSizeT(airplaneTypeName)].initialHP,
+					spawner.spawn(airplaneTypeName)
+				}
+			};
+			simulationBuffer.writeInitFrame(timestep, playerId, playerInfo);
+		}
+		simulationBuffer.update(timestep);
+	}
+};
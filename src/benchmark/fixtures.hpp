@@ -0,0 +1,16 @@
+#pragma once
+
+#include "common/mapName.hpp"
+#include "physics/simulationBuffer.hpp"
+#include "physics/timestep.hpp"
+
+#include <vector>
+
+namespace Benchmark
+{
+	inline constexpr Common::MapName benchmarkMapName = Common::MapName::airport;
+
+	std::vector<int> getPlayerCounts();
+	void addPlayers(Physics::SimulationBuffer& simulationBuffer, const Physics::Timestep& timestep,
+		int playerCount);
+};
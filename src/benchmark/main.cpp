@@ -0,0 +1,96 @@
+#include "benchmark/playerManagerBenchmarks.hpp"
+#include "benchmark/runner.hpp"
+#include "benchmark/sceneBenchmarks.hpp"
+#include "benchmark/serializerBenchmarks.hpp"
+#include "benchmark/simulationBufferBenchmarks.hpp"
+#include "benchmark/terrainBenchmarks.hpp"
+#include "common/config.hpp"
+
+#include <charconv>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace Benchmark
+{
+	bool parseArguments(int argc, char** argv, std::string& filter,
+		std::vector<int>& rollbackDepths);
+	bool parseRollbackDepths(const std::string& argument, std::vector<int>& rollbackDepths);
+};
+
+int main(int argc, char** argv)
+{
+	using namespace Benchmark;
+
+	std::string filter{};
+	std::vector<int> rollbackDepths{};
+
+	if (!parseArguments(argc, argv, filter, rollbackDepths))
+	{
+		std::cerr << "Usage: " << argv[0] << " [nameFilter [rollbackDepth,...]]" << std::endl <<
+			"Rollback depths must be integers from 0 to " << Common::stepsPerSecond - 1 <<
+			"." << std::endl;
+		return 1;
+	}
+
+	Runner runner{filter};
+	runSerializerBenchmarks(runner);
+	runSimulationBufferBenchmarks(runner, rollbackDepths);
+	runSceneBenchmarks(runner);
+	runTerrainBenchmarks(runner);
+	runPlayerManagerBenchmarks(runner);
+
+	return 0;
+};
+
+namespace Benchmark
+{
+	bool parseArguments(int argc, char** argv, std::string& filter,
+		std::vector<int>& rollbackDepths)
+	{
+		if (argc > 3)
+		{
+			return false;
+		}
+
+		if (argc > 1)
+		{
+			filter = argv[1];
+		}
+
+		if (argc > 2)
+		{
+			return parseRollbackDepths(argv[2], rollbackDepths);
+		}
+
+		rollbackDepths =
+		{
+			1,
+			Common::stepsPerSecond / 10,
+			Common::stepsPerSecond / 2
+		};
+		return true;
+	}
+
+	bool parseRollbackDepths(const std::string& argument, std::vector<int>& rollbackDepths)
+	{
+		std::stringstream stream{argument};
+		std::string rollbackDepthString{};
+		while (std::getline(stream, rollbackDepthString, ','))
+		{
+			int rollbackDepth{};
+			const char* end = rollbackDepthString.data() + rollbackDepthString.size();
+			std::from_chars_result result =
+				std::from_chars(rollbackDepthString.data(), end, rollbackDepth);
+			if (result.ec != std::errc{} || result.ptr != end || rollbackDepth < 0 ||
+				rollbackDepth >= Common::stepsPerSecond)
+			{
+				return false;
+			}
+			rollbackDepths.push_back(rollbackDepth);
+		}
+		return !rollbackDepths.empty();
+	}
+};
@@ -0,0 +1,84 @@
+#include "benchmark/playerManagerBenchmarks.hpp"
+
+#include "app/playerData.hpp"
+#include "app/playerManager.hpp"
+#include "app/playerSlots.hpp"
+#include "benchmark/runner.hpp"
+#include "common/config.hpp"
+#include "physics/timestep.hpp"
+
+#include <asio/asio.hpp>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Benchmark
+{
+	namespace
+	{
+		asio::ip::udp::endpoint getEndpoint(int index)
+		{
+			static constexpr int basePort = 20000;
+			return asio::ip::udp::endpoint{asio::ip::address_v4::loopback(),
+				static_cast<asio::ip::port_type>(basePort + index)};
+		}
+	};
+
+	void runPlayerManagerBenchmarks(Runner& runner)
+	{
+		static const std::string name = "playerManagerContention";
+		if (!runner.isSelected(name))
+		{
+			return;
+		}
+
+		static constexpr int iterations = 100000;
+		static constexpr int operationsPerIteration = 3;
+		static const std::vector<int> threadCounts{1, 2, 4, 8};
+
+		for (int threadCount : threadCounts)
+		{
+			App::PlayerManager playerManager{};
+			Physics::Timestep timestep{};
+			for (int i = 0; i < static_cast<int>(Common::maxPlayerCount); ++i)
+			{
+				playerManager.addNewPlayer(getEndpoint(i), timestep);
+			}
+
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			std::vector<std::thread> threads{};
+			for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+			{
+				threads.emplace_back
+				(
+					[&playerManager, &timestep, threadIndex]
+					{
+						asio::ip::udp::endpoint endpoint = getEndpoint(threadIndex);
+						App::PlayerSlots<App::PlayerData> players{};
+						for (int i = 0; i < iterations; ++i)
+						{
+							std::optional<int> playerId = playerManager.getPlayerId(endpoint);
+							if (playerId)
+							{
+								playerManager.bumpPlayer(*playerId, timestep);
+							}
+							playerManager.getPlayers(players);
+						}
+					}
+				);
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+			std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+			runner.report(name, {{"threads", threadCount}},
+				static_cast<long long>(threadCount) * iterations * operationsPerIteration,
+				std::chrono::duration_cast<std::chrono::nanoseconds>(end - start));
+		}
+	}
+};
@@ -0,0 +1,64 @@
+#include "benchmark/runner.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+	Runner::Runner(const std::string& filter) :
+		m_filter{filter}
+	{ }
+
+	bool Runner::isSelected(const std::string& name) const
+	{
+		return name.find(m_filter) != std::string::npos;
+	}
+
+	void Runner::run(const std::string& name, const std::vector<Parameter>& parameters,
+		int iterations, const std::function<void()>& iteration)
+	{
+		if (!isSelected(name))
+		{
+			return;
+		}
+
+		int warmupIterations = iterations / 10;
+		for (int i = 0; i < warmupIterations; ++i)
+		{
+			iteration();
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i)
+		{
+			iteration();
+		}
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+		report(name, parameters, iterations,
+			std::chrono::duration_cast<std::chrono::nanoseconds>(end - start));
+	}
+
+	void Runner::report(const std::string& name, const std::vector<Parameter>& parameters,
+		long long operations, const std::chrono::nanoseconds& duration)
+	{
+		std::cout << "{\"name\":\"" << name << "\",\"parameters\":{";
+		for (std::size_t i = 0; i < parameters.size(); ++i)
+		{
+			if (i > 0)
+			{
+				std::cout << ',';
+			}
+			std::cout << '"' << parameters[i].name << "\":" << parameters[i].value;
+		}
+		std::cout << "},\"operations\":" << operations <<
+			",\"totalNs\":" << duration.count() <<
+			",\"nsPerOperation\":" <<
+			static_cast<double>(duration.count()) / static_cast<double>(operations) << '}' <<
+			std::endl;
+	}
+};
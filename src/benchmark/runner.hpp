@@ -0,0 +1,29 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+	struct Parameter
+	{
+		std::string name;
+		int value{};
+	};
+
+	class Runner
+	{
+	public:
+		Runner(const std::string& filter);
+		bool isSelected(const std::string& name) const;
+		void run(const std::string& name, const std::vector<Parameter>& parameters,
+			int iterations, const std::function<void()>& iteration);
+		void report(const std::string& name, const std::vector<Parameter>& parameters,
+			long long operations, const std::chrono::nanoseconds& duration);
+
+	private:
+		std::string m_filter;
+	};
+};
@@ -0,0 +1,43 @@
+#include "benchmark/sceneBenchmarks.hpp"
+
+#include "benchmark/fixtures.hpp"
+#include "benchmark/runner.hpp"
+#include "common/config.hpp"
+#include "physics/playerInput.hpp"
+#include "physics/simulationBuffer.hpp"
+#include "physics/timestep.hpp"
+
+namespace Benchmark
+{
+	void runSceneBenchmarks(Runner& runner)
+	{
+		static constexpr int bulletBuildUpSteps = Common::stepsPerSecond * 2;
+		static constexpr int iterations = Common::stepsPerSecond * 10;
+
+		for (int playerCount : getPlayerCounts())
+		{
+			Physics::SimulationBuffer simulationBuffer{-1, benchmarkMapName};
+			Physics::Timestep timestep{};
+			addPlayers(simulationBuffer, timestep, playerCount);
+
+			Physics::PlayerInput firingInput{};
+			firingInput.airplaneCtrl.trigger = true;
+			for (int playerId = 0; playerId < playerCount; ++playerId)
+			{
+				simulationBuffer.writeControlFrame(timestep, playerId, firingInput);
+			}
+			for (int i = 0; i < bulletBuildUpSteps; ++i)
+			{
+				timestep = timestep.next();
+				simulationBuffer.update(timestep);
+			}
+
+			runner.run("sceneStepWithBullets", {{"players", playerCount}}, iterations,
+				[&]
+				{
+					timestep = timestep.next();
+					simulationBuffer.update(timestep);
+				});
+		}
+	}
+};
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "benchmark/runner.hpp"
+
+namespace Benchmark
+{
+	void runSceneBenchmarks(Runner& runner);
+};
@@ -0,0 +1,91 @@
+#include "benchmark/serializerBenchmarks.hpp"
+
+#include "app/udp/udpSerializer.hpp"
+#include "benchmark/fixtures.hpp"
+#include "benchmark/runner.hpp"
+#include "common/airplaneTypeName.hpp"
+#include "physics/playerInfo.hpp"
+#include "physics/playerInput.hpp"
+#include "physics/simulationBuffer.hpp"
+#include "physics/timestamp.hpp"
+#include "physics/timestep.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Benchmark
+{
+	void runSerializerBenchmarks(Runner& runner)
+	{
+		static constexpr int iterations = 100000;
+
+		std::vector<std::uint8_t> buffer{};
+		Physics::Timestamp clientTimestamp{};
+		Physics::Timestamp serverTimestamp{};
+		Physics::Timestep timestep{};
+		Common::AirplaneTypeName airplaneTypeName{};
+		int playerId{};
+		Physics::PlayerInput playerInput{};
+
+		runner.run("serializeInitReqFrame", {}, iterations,
+			[&]
+			{
+				buffer.clear();
+				App::UDPSerializer::serializeInitReqFrame(clientTimestamp, airplaneTypeName,
+					buffer);
+			});
+		std::vector<std::uint8_t> initReqFrame = buffer;
+		runner.run("deserializeInitReqFrame", {}, iterations,
+			[&]
+			{
+				App::UDPSerializer::deserializeInitReqFrame(initReqFrame, clientTimestamp,
+					airplaneTypeName);
+			});
+
+		runner.run("serializeInitResFrame", {}, iterations,
+			[&]
+			{
+				buffer.clear();
+				App::UDPSerializer::serializeInitResFrame(clientTimestamp, serverTimestamp,
+					playerId, buffer);
+			});
+
+		runner.run("serializeControlFrame", {}, iterations,
+			[&]
+			{
+				buffer.clear();
+				App::UDPSerializer::serializeControlFrame(clientTimestamp, serverTimestamp,
+					timestep, playerId, playerInput, buffer);
+			});
+		std::vector<std::uint8_t> controlFrame = buffer;
+		runner.run("deserializeControlFrame", {}, iterations,
+			[&]
+			{
+				App::UDPSerializer::deserializeControlFrame(controlFrame, clientTimestamp,
+					serverTimestamp, timestep, playerId, playerInput);
+			});
+
+		for (int playerCount : getPlayerCounts())
+		{
+			Physics::SimulationBuffer simulationBuffer{-1, benchmarkMapName};
+			Physics::Timestep initialTimestep{};
+			addPlayers(simulationBuffer, initialTimestep, playerCount);
+			std::unordered_map<int, Physics::PlayerInfo> playerInfos =
+				simulationBuffer.getPlayerInfos(initialTimestep);
+
+			runner.run("serializeStateFrame", {{"players", playerCount}}, iterations,
+				[&]
+				{
+					buffer.clear();
+					App::UDPSerializer::serializeStateFrame(initialTimestep, playerInfos, buffer);
+				});
+			std::vector<std::uint8_t> stateFrame = buffer;
+			runner.run("deserializeStateFrame", {{"players", playerCount}}, iterations,
+				[&]
+				{
+					App::UDPSerializer::deserializeStateFrame(stateFrame, timestep, playerInfos);
+				});
+		}
+	}
+};
@@ -0,0 +1,63 @@
+#include "benchmark/simulationBufferBenchmarks.hpp"
+
+#include "benchmark/fixtures.hpp"
+#include "benchmark/runner.hpp"
+#include "common/config.hpp"
+#include "physics/playerInfo.hpp"
+#include "physics/playerInput.hpp"
+#include "physics/simulationBuffer.hpp"
+#include "physics/timestep.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Benchmark
+{
+	void runSimulationBufferBenchmarks(Runner& runner, const std::vector<int>& rollbackDepths)
+	{
+		static constexpr int updateIterations = Common::stepsPerSecond * 10;
+		static constexpr int rollbackIterations = Common::stepsPerSecond;
+
+		for (int playerCount : getPlayerCounts())
+		{
+			Physics::SimulationBuffer simulationBuffer{-1, benchmarkMapName};
+			Physics::Timestep timestep{};
+			addPlayers(simulationBuffer, timestep, playerCount);
+
+			runner.run("simulationBufferUpdate", {{"players", playerCount}}, updateIterations,
+				[&]
+				{
+					timestep = timestep.next();
+					simulationBuffer.update(timestep);
+				});
+
+			runner.run("simulationBufferGetPlayerInfos", {{"players", playerCount}},
+				updateIterations,
+				[&]
+				{
+					std::unordered_map<int, Physics::PlayerInfo> playerInfos =
+						simulationBuffer.getPlayerInfos(timestep);
+				});
+
+			for (int rollbackDepth : rollbackDepths)
+			{
+				runner.run("simulationBufferUpdateWithRollback",
+					{{"players", playerCount}, {"rollbackDepth", rollbackDepth}},
+					rollbackIterations,
+					[&]
+					{
+						timestep = timestep.next();
+						Physics::Timestep rollbackTimestep =
+							timestep - Physics::Timestep{0, static_cast<unsigned int>(rollbackDepth)};
+						simulationBuffer.writeControlFrame(rollbackTimestep, 0,
+							Physics::PlayerInput{});
+						for (Physics::Timestep step = rollbackTimestep; !(timestep < step);
+							step = step.next())
+						{
+							simulationBuffer.update(step);
+						}
+					});
+			}
+		}
+	}
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "benchmark/runner.hpp"
+
+#include <vector>
+
+namespace Benchmark
+{
+	void runSimulationBufferBenchmarks(Runner& runner, const std::vector<int>& rollbackDepths);
+};
@@ -0,0 +1,38 @@
+#include "benchmark/terrainBenchmarks.hpp"
+
+#include "benchmark/runner.hpp"
+#include "common/config.hpp"
+#include "common/mapName.hpp"
+#include "common/terrains/maps/map.hpp"
+#include "common/terrains/maps/maps.hpp"
+
+#include <cstddef>
+
+namespace Benchmark
+{
+	void runTerrainBenchmarks(Runner& runner)
+	{
+		static constexpr int iterations = 1000000;
+		static constexpr int gridSize = 1000;
+		static constexpr float gridExtent = 5000;
+		static constexpr float gridSpacing = 2 * gridExtent / gridSize;
+
+		for (int mapIndex = 0; mapIndex < Common::mapCount; ++mapIndex)
+		{
+			const Common::Terrains::Map& map =
+				*Common::Terrains::maps[static_cast<std::size_t>(mapIndex)];
+			int query = 0;
+			float heightSum = 0;
+
+			runner.run("terrainHeight", {{"map", mapIndex}}, iterations,
+				[&]
+				{
+					float x = static_cast<float>(query % gridSize) * gridSpacing - gridExtent;
+					float z = static_cast<float>(query / gridSize % gridSize) * gridSpacing -
+						gridExtent;
+					heightSum += map.getHeight(x, z);
+					++query;
+				});
+		}
+	}
+};